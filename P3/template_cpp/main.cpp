@@ -3,13 +3,16 @@
 #include <cstdint>
 #include <iostream>
 #include <stdio.h>
+#include <string.h>
 #include "CodeGen.H"
 
+bool optimizeLayout = false;
+
 int process(FILE *input) {
 
   Program *parse_tree = pProgram(input);
   if (parse_tree) {
-    CodeGen codegen;
+    CodeGen codegen(optimizeLayout);
     codegen.generate(parse_tree);
     //std::cout << "OK" << std::endl;
   } else {
@@ -24,10 +27,12 @@ int main(int argc, char **argv) {
   FILE *input;
   char *filename = NULL;
 
-  if (argc > 1) {
-    filename = argv[1];
-  } else {
-    input = stdin;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--opt-layout") == 0) {
+      optimizeLayout = true;
+    } else {
+      filename = argv[i];
+    }
   }
 
   if (filename) {